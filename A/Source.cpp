@@ -102,6 +102,40 @@ Given that we don't know if the problem will run in time we can run it locally
 to test how fast it is (which if your brute force is optimized it should
 definitely be fast enough) or simply print all the answers and put them in a
 precalculated array.
+
+Note: That's what is done here, the DFS is kept behind -DGENERATE and its
+output is pasted below as a flat table, so the program does no work at startup
+and every query is a single row lookup. To change it compile with -DGENERATE
+-DmaxN=X (and -DmaxLen=Y if some target needs more than 9 folds) and paste the
+output back. The generator deepens the DFS until every target has a chain, and
+stops with an error if one needs more than maxLen folds.
+
+Note2: For N up to 10^5 (compile with -DLARGE) neither the table nor a DFS
+over every target work, so targets outside the table are searched when they are
+asked with iterative deepening: we try D = 1, 2, ... folds and stop at the first D
+that reaches N, so the chain found is optimal. D starts at a lower bound
+instead of 1: with B bits we need at least B - 1 folds to reach the biggest
+power of 2 below N, one more if O >= 2, one more if O >= 3 and one more if
+O >= 5 (these last ones are known results on addition chains).
+
+Inside an iteration a state is dropped when it can't reach N anymore: every
+fold at most doubles the biggest number V, so we need V * 2^R >= N with R folds
+left, and if N isn't exactly V * 2^R some fold adds less than V. Also in an
+optimal chain every number is used by a later fold (otherwise we could remove
+it), so we can't have more unused numbers than the folds left can use. With 1
+or 2 folds left we don't branch, we look directly for the sums that give N.
+Sums are tried from the biggest down, which usually reaches N early in the
+last iteration. Most targets take a few seconds, the worst ones close to 10^5
+can take a couple of minutes.
+
+Note3: The branches of the DFS never share a state, so generating the table for
+a bigger maxN can use several cores (compile with -DGENERATE -DTHREADS=T). The
+first SPLIT folds are expanded by a single DFS and every node it reaches there
+becomes a task. Tasks are handed out in blocks, every thread takes its own
+from the back of its queue and one that runs out steals from the front of
+another one's queue. Every thread keeps its own stack and best chains, which
+are merged at the end preferring fewer folds and then the task that comes first
+in DFS order, so the table is the same for any number of threads.
 */
 
 #include <bits/stdc++.h>
@@ -109,14 +143,14 @@ precalculated array.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -139,45 +173,418 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+// Targets of the table and the most folds a row can hold.
+#ifndef maxN
 #define maxN 101
+#endif
+#ifndef maxLen
+#define maxLen 9
+#endif
+
+#ifdef GENERATE
+#ifndef THREADS
+#define THREADS 1
+#endif
+// The tree is cut after SPLIT folds, every node there is a task.
+#define SPLIT 5
+
+// The DFS stops after depth folds, generate() raises it until every target
+// below maxN has a chain.
+int depth;
+
+struct Task {
+  int arr[maxLen + 1], cnt;
+  vi cur;
+};
+
+// The best chain for a target and the task it was found in.
+struct Best {
+  vi cur;
+  int task;
+};
+
+// One DFS with its own stack. Ties in the number of folds go to the first task
+// in DFS order, so any split gives the same table as a single DFS.
+struct Search {
+  map<int, Best> mem;
+  vi cur;
+  int arr[maxLen + 1], cnt = 0, task = -1;
+  vector<Task>* tasks = NULL;  // Where the driver leaves the nodes at SPLIT.
+
+  void record(int ne, const vi& c, int t) {
+    map<int, Best>::iterator it = mem.find(ne);
+    if (it == mem.end() || it->second.cur.size() > c.size() ||
+        (it->second.cur.size() == c.size() && it->second.task > t)) {
+      mem[ne] = {c, t};
+    }
+  }
 
-map<int, vi> mem;
-vi cur;
-int arr[11], cnt = 0;
-
-void resolve() {
-  if (cnt >= 10) return;
-  int last = arr[cnt - 1];
-  FOR(i, 0, cnt) {
-    FOR(j, i, cnt) {
-      int ne = arr[i] + arr[j];
-      if (ne <= last || ne >= maxN) continue;
-      cur.push_back(arr[i]);
-      cur.push_back(arr[j]);
-      arr[cnt++] = ne;
-      if (mem.find(ne) == mem.end() || mem[ne].size() > cur.size()) {
-        mem[ne] = cur;
+  void resolve() {
+    if (cnt > depth) return;
+    int last = arr[cnt - 1];
+    FOR(i, 0, cnt) {
+      FOR(j, i, cnt) {
+        int ne = arr[i] + arr[j];
+        if (ne <= last || ne >= maxN) continue;
+        cur.push_back(arr[i]);
+        cur.push_back(arr[j]);
+        arr[cnt++] = ne;
+        record(ne, cur, task);
+        if (tasks && cnt > SPLIT) {
+          tasks->push_back(Task());
+          Task& t = tasks->back();
+          copy(arr, arr + cnt, t.arr);
+          t.cnt = cnt;
+          t.cur = cur;
+        } else {
+          resolve();
+        }
+        cur.pop_back();
+        cur.pop_back();
+        cnt--;
       }
-      resolve();
-      cur.pop_back();
-      cur.pop_back();
-      cnt--;
     }
   }
+};
+
+vector<Task> tasks;
+Search workers[THREADS];
+deque<int> pending[THREADS];
+mutex pendingLock[THREADS];
+
+// Takes the last task of our own queue or steals the first one of another.
+bool take(int w, int& t) {
+  FOR(k, 0, THREADS) {
+    int v = (w + k) % THREADS;
+    lock_guard<mutex> g(pendingLock[v]);
+    if (pending[v].empty()) continue;
+    if (k == 0) {
+      t = pending[v].back(), pending[v].pop_back();
+    } else {
+      t = pending[v].front(), pending[v].pop_front();
+    }
+    return true;
+  }
+  return false;
+}
+
+void work(int w) {
+  Search& s = workers[w];
+  int t;
+  while (take(w, t)) {
+    copy(tasks[t].arr, tasks[t].arr + tasks[t].cnt, s.arr);
+    s.cnt = tasks[t].cnt;
+    s.cur = tasks[t].cur;
+    s.task = t;
+    s.resolve();
+  }
+}
+
+// Searches with at most depth folds, found chains are optimal.
+void run(Search& root) {
+  tasks.clear();
+  FOR(w, 0, THREADS) workers[w] = Search();
+  root.arr[0] = 1;
+  root.cnt = 1;
+  root.tasks = &tasks;
+  root.resolve();
+  FOR(t, 0, tasks.size()) pending[t * THREADS / tasks.size()].pb(t);
+  if (THREADS == 1) {
+    work(0);
+  } else {
+    vector<thread> th;
+    FOR(w, 0, THREADS) th.emplace_back(work, w);
+    FORC(th, it) it->join();
+  }
+  FOR(w, 0, THREADS) {
+    FORC(workers[w].mem, it) {
+      root.record(it->first, it->second.cur, it->second.task);
+    }
+  }
+}
+
+bool complete(Search& root) {
+  FOR(n, 2, maxN) if (!root.mem.count(n)) return false;
+  return true;
+}
+
+// Prints the table below, one row per N. Every target needs at least B - 1
+// folds for the biggest one, and no row can have more than maxLen.
+void generate() {
+  Search root;
+  for (depth = 31 - __builtin_clz(maxN - 1); depth <= maxLen; depth++) {
+    root = Search();
+    run(root);
+    if (complete(root)) break;
+  }
+  FOR(n, 2, maxN) {
+    if (!root.mem.count(n) || (int)root.mem[n].cur.size() / 2 > maxLen) {
+      fprintf(stderr, "No chain for %d with at most %d folds\n", n, maxLen);
+      exit(1);
+    }
+  }
+  FOR(n, 0, maxN) {
+    vi& c = root.mem[n].cur;
+    writeStr("    {");
+    writeInt(c.size() / 2);
+    FORC(c, it) writeStr(", "), writeInt(*it);
+    writeStr("},\n");
+  }
+}
+#endif
+
+#ifdef LARGE
+#define maxD 32
+
+int target, len, chain[maxD], from[maxD][2];
+int used[maxD], unused = 0;
+
+// Appends chain[i] + chain[j] to the chain.
+void push(int i, int j) {
+  from[len][0] = chain[i], from[len][1] = chain[j];
+  chain[len] = chain[i] + chain[j];
+  unused -= !used[i]++;
+  unused -= !used[j]++;
+  used[len++] = 0;
+  unused++;
+}
+
+void pop(int i, int j) {
+  len--;
+  unused--;
+  unused += !--used[j];
+  unused += !--used[i];
+}
+
+// Looks for chain[i] + chain[j] == s with i <= j, chain is increasing.
+bool pairSum(int s, int& i, int& j) {
+  for (i = 0, j = len - 1; i <= j;) {
+    int t = chain[i] + chain[j];
+    if (t == s) return true;
+    t < s ? i++ : j--;
+  }
+  return false;
+}
+
+bool last1() {
+  int i, j;
+  if (!pairSum(target, i, j)) return false;
+  push(i, j);
+  return true;
+}
+
+// The fold before target makes some e in (last, 2 * last], then target is
+// either e doubled or e plus something already in the chain, so we only check
+// the numbers of the chain that leave an e in that range.
+bool last2() {
+  int last = chain[len - 1], i, j;
+  bool found = target % 2 == 0 && target / 2 > last &&
+               pairSum(target / 2, i, j);
+  for (int k = len - 1; !found && k >= 0; k--) {
+    int e = target - chain[k];
+    if (e > 2 * last) break;
+    found = e > last && pairSum(e, i, j);
+  }
+  if (!found) return false;
+  push(i, j);
+  return last1();
+}
+
+// Whether a chain whose 2 biggest numbers are a > b can reach target in d
+// folds. Unless we only double, the first fold that doesn't double adds at
+// most b, or half of the biggest number if we doubled before it.
+bool reaches(ll a, ll b, int d) {
+  if ((a << d) == target) return true;
+  if ((a << d) < target) return false;
+  return (max(2 * (a + b), 3 * a) << (d - 1)) >= 2 * target;
+}
+
+// Tries to reach target from chain[0..len) with at most d more folds.
+bool extend(int d) {
+  int last = chain[len - 1];
+  if (last == target) return true;
+  if (d == 0) return false;
+  // A number that is never used again could be dropped from the chain, so in
+  // an optimal one it is used later. The d folds left have 2d operands and the
+  // d - 1 new numbers before target take one each, the rest d + 1 can go to
+  // the unused numbers we already have.
+  if (unused > d + 1 || !reaches(last, len > 1 ? chain[len - 2] : 0, d)) {
+    return false;
+  }
+  if (d == 1) return last1();
+  if (d == 2) return last2();
+  // Candidates packed as (sum, i, j) so sorting puts the biggest sums first.
+  // The chain is increasing, so sums only go down as i and j do and we can
+  // stop as soon as they are too small to be new or to reach target in time.
+  ll next[maxD * (maxD + 1) / 2];
+  int k = 0, lo = max(last + 1, (int)((target - 1) >> (d - 1)) + 1);
+  for (int j = len - 1; j >= 0 && 2 * chain[j] >= lo; j--) {
+    for (int i = j; i >= 0 && chain[i] + chain[j] >= lo; i--) {
+      int ne = chain[i] + chain[j];
+      if (ne > target || !reaches(ne, last, d - 1)) continue;
+      next[k++] = (ll)ne << 16 | i << 8 | j;
+    }
+  }
+  sort(next, next + k, greater<ll>());
+  FOR(c, 0, k) {
+    if (c && (next[c] >> 16) == (next[c - 1] >> 16)) continue;
+    int i = next[c] >> 8 & 255, j = next[c] & 255;
+    push(i, j);
+    if (extend(d - 1)) return true;
+    pop(i, j);
+  }
+  return false;
 }
 
+int lowerBound(int n) {
+  int b = 32 - __builtin_clz(n), o = __builtin_popcount(n);
+  return b - 1 + (o >= 2) + (o >= 3) + (o >= 5);
+}
+
+// Leaves an optimal chain for n in chain[0..len), from[k] made chain[k].
+void search(int n) {
+  target = n;
+  for (int d = lowerBound(n);; d++) {
+    chain[0] = 1;
+    used[0] = 0;
+    len = unused = 1;
+    if (extend(d)) return;
+  }
+}
+#endif
+
+// Generated with -DGENERATE. fold[N] = {folds, a1, b1, a2, b2, ...}, where
+// fold k adds a[k] + b[k] to the set.
+const int fold[][2 * maxLen + 1] = {
+    {0},
+    {0},
+    {1, 1, 1},
+    {2, 1, 1, 1, 2},
+    {2, 1, 1, 2, 2},
+    {3, 1, 1, 1, 2, 2, 3},
+    {3, 1, 1, 1, 2, 3, 3},
+    {4, 1, 1, 1, 2, 1, 3, 3, 4},
+    {3, 1, 1, 2, 2, 4, 4},
+    {4, 1, 1, 1, 2, 3, 3, 3, 6},
+    {4, 1, 1, 1, 2, 2, 3, 5, 5},
+    {5, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7},
+    {4, 1, 1, 1, 2, 3, 3, 6, 6},
+    {5, 1, 1, 1, 2, 2, 3, 3, 5, 5, 8},
+    {5, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7},
+    {5, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10},
+    {4, 1, 1, 2, 2, 4, 4, 8, 8},
+    {5, 1, 1, 2, 2, 4, 4, 1, 8, 8, 9},
+    {5, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9},
+    {6, 1, 1, 1, 2, 1, 3, 4, 4, 3, 8, 8, 11},
+    {5, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10},
+    {6, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14},
+    {6, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11},
+    {6, 1, 1, 1, 2, 2, 3, 5, 5, 3, 10, 10, 13},
+    {5, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12},
+    {6, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 10, 15},
+    {6, 1, 1, 1, 2, 2, 3, 3, 5, 5, 8, 13, 13},
+    {6, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9, 9, 18},
+    {6, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 14, 14},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 7, 11, 11, 18},
+    {6, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 15, 15},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 3, 14, 14, 17},
+    {5, 1, 1, 2, 2, 4, 4, 8, 8, 16, 16},
+    {6, 1, 1, 2, 2, 4, 4, 8, 8, 1, 16, 16, 17},
+    {6, 1, 1, 2, 2, 4, 4, 1, 8, 8, 9, 17, 17},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14, 14, 21},
+    {6, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9, 18, 18},
+    {7, 1, 1, 1, 2, 2, 3, 3, 5, 8, 8, 5, 16, 16, 21},
+    {7, 1, 1, 1, 2, 1, 3, 4, 4, 3, 8, 8, 11, 19, 19},
+    {7, 1, 1, 1, 2, 2, 3, 3, 5, 5, 8, 13, 13, 13, 26},
+    {6, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 20, 20},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 1, 20, 20, 21},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14, 21, 21},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 3, 20, 20, 23},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 22, 22},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 15, 15, 15, 30},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 3, 10, 10, 13, 23, 23},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 3, 7, 10, 10, 7, 20, 20, 27},
+    {6, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 24, 24},
+    {7, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 1, 24, 24, 25},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 10, 15, 25, 25},
+    {7, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 3, 24, 24, 27},
+    {7, 1, 1, 1, 2, 2, 3, 3, 5, 5, 8, 13, 13, 26, 26},
+    {8, 1, 1, 1, 2, 2, 3, 1, 5, 6, 6, 12, 12, 5, 24, 24, 29},
+    {7, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9, 9, 18, 27, 27},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 11, 22, 22, 33},
+    {7, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 14, 14, 28, 28},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 14, 14, 1, 28, 28, 29},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 7, 11, 11, 18, 29, 29},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 14, 14, 3, 28, 28, 31},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 15, 15, 30, 30},
+    {8, 1, 1, 1, 2, 2, 3, 2, 5, 7, 7, 14, 14, 5, 28, 28, 33},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 3, 14, 14, 17, 31, 31},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14, 21, 21, 21, 42},
+    {6, 1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 32, 32},
+    {7, 1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 1, 32, 32, 33},
+    {7, 1, 1, 2, 2, 4, 4, 8, 8, 1, 16, 16, 17, 33, 33},
+    {8, 1, 1, 1, 2, 1, 3, 4, 4, 8, 8, 16, 16, 3, 32, 32, 35},
+    {7, 1, 1, 2, 2, 4, 4, 1, 8, 8, 9, 17, 17, 34, 34},
+    {8, 1, 1, 1, 2, 2, 3, 3, 5, 8, 8, 16, 16, 5, 32, 32, 37},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14, 14, 21, 35, 35},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 1, 7, 8, 8, 16, 16, 7, 32, 32, 39},
+    {7, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9, 18, 18, 36, 36},
+    {8, 1, 1, 1, 2, 3, 3, 3, 6, 9, 9, 18, 18, 1, 36, 36, 37},
+    {8, 1, 1, 1, 2, 2, 3, 3, 5, 8, 8, 5, 16, 16, 21, 37, 37},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 10, 15, 25, 25, 25, 50},
+    {8, 1, 1, 1, 2, 1, 3, 4, 4, 3, 8, 8, 11, 19, 19, 38, 38},
+    {8, 1, 1, 2, 2, 1, 4, 4, 5, 9, 9, 18, 18, 5, 36, 36, 41},
+    {8, 1, 1, 1, 2, 2, 3, 3, 5, 5, 8, 13, 13, 13, 26, 39, 39},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 2, 7, 9, 9, 18, 18, 7, 36, 36, 43},
+    {7, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 20, 20, 40, 40},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 20, 20, 1, 40, 40, 41},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 1, 20, 20, 21, 41, 41},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 20, 20, 3, 40, 40, 43},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 7, 14, 21, 21, 42, 42},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 20, 20, 5, 40, 40, 45},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 10, 10, 3, 20, 20, 23, 43, 43},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 3, 7, 10, 10, 20, 20, 7, 40, 40, 47},
+    {8, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 22, 22, 44, 44},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 22, 22, 1, 44, 44, 45},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 15, 15, 15, 30, 45, 45},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 22, 22, 3, 44, 44, 47},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 3, 10, 10, 13, 23, 23, 46, 46},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 7, 7, 3, 14, 14, 17, 31, 31, 31, 62},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 3, 7, 10, 10, 7, 20, 20, 27, 47, 47},
+    {9, 1, 1, 1, 2, 1, 3, 3, 4, 4, 7, 11, 11, 22, 22, 7, 44, 44, 51},
+    {7, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 24, 24, 48, 48},
+    {8, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 24, 24, 1, 48, 48, 49},
+    {8, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 1, 24, 24, 25, 49, 49},
+    {8, 1, 1, 1, 2, 3, 3, 6, 6, 12, 12, 24, 24, 3, 48, 48, 51},
+    {8, 1, 1, 1, 2, 2, 3, 5, 5, 5, 10, 10, 15, 25, 25, 50, 50},
+};
+const int rows = sizeof(fold) / sizeof(fold[0]);
+
 int main(int argc, char* argv[]) {
+#ifdef GENERATE
+  generate();
+  flushOut();
+  return 0;
+#endif
   _;
-  arr[0] = 1;
-  cnt = 1;
-  resolve();
   int M, N;
-  while (cin >> M >> N) {
+  while (readInt(M) && readInt(N)) {
     if (M != 1) {
-      cout << "*" << endl;
-    } else {
-      FOR(i, 0, mem[N].size()) { cout << "1 " << mem[N][i] << endl; }
+      writeStr("*\n");
+    } else if (0 <= N && N < rows) {
+      FOR(i, 1, 2 * fold[N][0] + 1) {
+        writeStr("1 "), writeInt(fold[N][i]), writeChar('\n');
+      }
+    }
+#ifdef LARGE
+    else if (N > 0) {
+      search(N);
+      FOR(i, 1, len) {
+        writeStr("1 "), writeInt(from[i][0]), writeChar('\n');
+        writeStr("1 "), writeInt(from[i][1]), writeChar('\n');
+      }
     }
+#endif
   }
   return 0;
 }
@@ -108,6 +108,36 @@ in position i we make every divisor or i-1 invalid.
 Note: To solve this I did 1 single function and run the DFA and the 3 checks in
 there. I call the function with the array and the reversed array.
 
+Note2: The divisors of every number are stored together in a single array,
+divisors[start[j]..start[j+1]) are the divisors of j in increasing order, so
+in mark() we can binary search the first divisor bigger or equal to y.
+
+Note3: If the numbers arrive one at a time (compile with -DONLINE) the first 3
+checks only depend on what we have seen so far, so they are done as each number
+arrives. For the tail, a K has its last block starting at s, the biggest
+multiple of K smaller than the amount of numbers. Reading the DFA from the end
+the block from s is valid if either:
+ - It's a single number (s is the last position).
+ - There's no "down then up" in it (s > V) and it goes up at some point (s <= U)
+   where V and U are the left ends of the last such sequence and of the last
+   increase.
+ - It never goes up, it has at least 3 numbers and A[s] is either -1 or equal to
+   the next known number (the DFA ends in state 2).
+So we keep 2 Fenwick trees with how many valid Ks have their last block
+starting at s (for the third case only the s that are equal), a K only moves
+when its block ends so per number we only touch the divisors of its position.
+
+Note4: Both passes only remove Ks, so they can run at the same time (compile
+with -DTHREADS=2), the second one reads A backwards instead of reversing it and
+valid is a bitset of atomic words so removing a K is a single fetch_and. At the
+end we only need to know if any bit from 3 to N is still on, 64 at a time.
+
+Note5: For N up to 10^7 (compile with -DLARGE) the table of divisors doesn't fit
+in memory, so we only keep the smallest prime factor of every number and build
+the divisors of a number from its factorization when we need them. The
+divisors of 0 are every K, but only the ones up to N matter. Before every case
+we only turn on the words of valid that we are going to use.
+
 */
 
 #include <bits/stdc++.h>
@@ -115,19 +145,20 @@ there. I call the function with the array and the reversed array.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
 
 typedef long long ll;
+typedef unsigned long long ull;
 typedef pair<int, int> ii;
 typedef vector<int> vi;
 typedef vector<ii> vii;
@@ -145,93 +176,269 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+#ifndef maxN
+#ifdef LARGE
+#define maxN 10000001
+#else
 #define maxN 100001
+#endif
+#endif
+#ifndef THREADS
+#define THREADS 1
+#endif
+
+int N, A[maxN];
+#ifdef LARGE
+int spf[maxN];
+#else
+int start[maxN + 1];
+vi divisors;
+#endif
+atomic<ull> valid[maxN / 64 + 1];
+
+// Only used by online(), the valid Ks smaller or equal to pool are in the
+// Fenwick trees at the position where their last block starts (at[K]).
+int pool, at[maxN], bit[2][maxN + 1];
+bool eq[maxN];
+
+struct DFA {
+  int p = -1, d = -1, state = 0, inv = -1;
+  bool inverted;
+  DFA(bool inverted = false) : inverted(inverted) {}
+  int a(int i) { return inverted ? A[N - 1 - i] : A[i]; }
+  void step(int i);
+};
+
+#ifdef LARGE
+void sieve() {
+  vi primes;
+  FOR(i, 2, maxN) {
+    if (!spf[i]) spf[i] = i, primes.pb(i);
+    FORC(primes, p) {
+      if (*p > spf[i] || (ll)i * *p >= maxN) break;
+      spf[i * *p] = *p;
+    }
+  }
+}
 
-int N, A[maxN], valid[maxN];
-vi divisors[maxN];
+// Calls f(k) for every divisor k of j such that k >= y.
+template <class F>
+void forDivisors(int j, int y, F f) {
+  if (!j) {
+    FOR(k, max(y, 1), N + 1) f(k);
+    return;
+  }
+  int ds[1 << 10], c = 1;
+  ds[0] = 1;
+  while (j > 1) {
+    int p = spf[j], m = c;
+    // q stays a divisor of j, so it can't overflow.
+    for (int q = 1; j % p == 0;) {
+      j /= p, q *= p;
+      FOR(k, 0, m) ds[c++] = ds[k] * q;
+    }
+  }
+  FOR(k, 0, c) if (ds[k] >= y) f(ds[k]);
+}
+#else
+void sieve() {
+  FOR(i, 1, maxN) for (int j = 0; j < maxN; j += i) start[j + 1]++;
+  FOR(j, 0, maxN) start[j + 1] += start[j];
+  divisors.resize(start[maxN]);
+  vi pos(start, start + maxN);
+  FOR(i, 1, maxN) for (int j = 0; j < maxN; j += i) divisors[pos[j]++] = i;
+}
 
-void mark(int j, int y) {
-  FOR(i, 0, divisors[j].size()) {
-    int div = divisors[j][i];
-    if (div >= y) valid[div] = false;
+// Calls f(k) for every divisor k of j such that k >= y.
+template <class F>
+void forDivisors(int j, int y, F f) {
+  int *e = divisors.data() + start[j + 1];
+  for (int *it = lower_bound(divisors.data() + start[j], e, y); it != e; it++)
+    f(*it);
+}
+#endif
+
+void upd(int t, int i, int v) {
+  for (i++; i <= N; i += i & -i) bit[t][i] += v;
+}
+
+int sum(int t, int i) {
+  int r = 0;
+  for (i++; i > 0; i -= i & -i) r += bit[t][i];
+  return r;
+}
+
+bool some(int t, int lo, int hi) {
+  return lo <= hi && sum(t, hi) - sum(t, lo - 1) > 0;
+}
+
+void place(int k, int v) {
+  upd(0, at[k], v);
+  if (eq[at[k]]) upd(1, at[k], v);
+}
+
+void unequal(int s) {
+  if (!eq[s]) return;
+  eq[s] = false;
+  upd(1, s, sum(1, s - 1) - sum(1, s));
+}
+
+bool isValid(int k) { return valid[k >> 6].load() >> (k & 63) & 1; }
+
+// Returns if k was valid before.
+bool unmark(int k) {
+  ull b = 1ULL << (k & 63);
+  return isValid(k) && valid[k >> 6].fetch_and(~b) & b;
+}
+
+// Any valid K in [lo, hi].
+bool someValid(int lo, int hi) {
+  for (int w = lo >> 6; w <= hi >> 6; w++) {
+    ull b = valid[w].load();
+    if (w == lo >> 6) b &= ~0ULL << (lo & 63);
+    if (w == hi >> 6) b &= ~0ULL >> (63 - (hi & 63));
+    if (b) return true;
   }
+  return false;
 }
 
-void check(int inverted) {
-  int p = -1, d = -1, state = 0, inv = -1;
-  FOR(i, 1, N) {
-    // Sates:
-    // 0 -> After processing the first number
-    // 1 -> We are increasing
-    // 2 -> We are increasing but might be decreasing as well
-    // 3 -> We are decreasing
-    // 4 -> Invalid
-    int pv = d == -1 ? A[i] : A[d];
-    if (A[i] == -1 || A[i] == pv) {
-      if (state == 0)
-        state = 1;
-      else if (state == 1 || state == 2)
-        state = 2;
-      else if (state == 3)
-        state = 3;
-    } else if (A[i] > pv) {
-      if (state <= 2)
-        state = 1;
-      else
-        state = 4;
-    } else if (A[i] < pv) {
-      if (state == 0 || state == 4)
-        state = 4;
-      else
-        state = 3;
-    }
-    if (state != 2 && state != 3) {
-      if (!inverted)
-        mark(i + 1, i + 1);
-      else
-        mark(N - i - 1, i + 1);
+void mark(int j, int y) {
+  forDivisors(j, y, [](int k) {
+    if (unmark(k) && k <= pool) place(k, -1);
+  });
+}
+
+void DFA::step(int i) {
+  // Sates:
+  // 0 -> After processing the first number
+  // 1 -> We are increasing
+  // 2 -> We are increasing but might be decreasing as well
+  // 3 -> We are decreasing
+  // 4 -> Invalid
+  int pv = d == -1 ? a(i) : a(d);
+  if (a(i) == -1 || a(i) == pv) {
+    if (state == 0)
+      state = 1;
+    else if (state == 1 || state == 2)
+      state = 2;
+    else if (state == 3)
+      state = 3;
+  } else if (a(i) > pv) {
+    if (state <= 2)
+      state = 1;
+    else
+      state = 4;
+  } else if (a(i) < pv) {
+    if (state == 0 || state == 4)
+      state = 4;
+    else
+      state = 3;
+  }
+
+  // Invalid sequence by going down then up.
+  if (a(i) != -1) {
+    if (d != -1 && a(d) > a(i)) {
+      p = d;
+    } else if (d != -1 && p != -1 && a(i) > a(d)) {
+      inv = p;
     }
+    d = i;
+  }
+}
 
-    // 2 consecutives defined
-    if (!inverted && A[i] != -1 && A[i - 1] != -1) {
-      if (A[i] > A[i - 1]) {
-        mark(i + 1, 0);
-      } else if (A[i] < A[i - 1]) {
-        mark(i - 1, 0);
-      }
+void check(DFA &f, int i, int inverted) {
+  f.step(i);
+  if (f.state != 2 && f.state != 3) {
+    if (!inverted)
+      mark(i + 1, i + 1);
+    else
+      mark(N - i - 1, i + 1);
+  }
+
+  // 2 consecutives defined
+  if (!inverted && A[i] != -1 && A[i - 1] != -1) {
+    if (A[i] > A[i - 1]) {
+      mark(i + 1, 0);
+    } else if (A[i] < A[i - 1]) {
+      mark(i - 1, 0);
     }
+  }
 
-    // Invalid sequence by going down then up.
-    if (A[i] != -1) {
-      if (d != -1 && A[d] > A[i]) {
-        p = d;
-      } else if (d != -1 && p != -1 && A[i] > A[d]) {
-        inv = p;
-      }
-      d = i;
+  if (f.inv != -1) {
+    if (!inverted)
+      mark(i + 1, i - f.inv + 1);
+    else
+      mark(N - i - 1, i + 1);
+  }
+}
+
+void sweep(bool inverted) {
+  DFA f(inverted);
+  FOR(i, 1, N) check(f, i, inverted);
+}
+
+void reset() {
+  FOR(w, 0, (N >> 6) + 1) valid[w] = ~0ULL;
+  unmark(0), unmark(1), unmark(2);
+}
+
+void online() {
+  reset();
+  FOR(i, 0, N + 1) bit[0][i] = bit[1][i] = 0;
+  FOR(i, 0, N) eq[i] = true;
+  DFA f, r;
+  int U = -1;
+  pool = 0;
+  FOR(i, 0, N) {
+    readInt(A[i]);
+    // The Ks that divide i start a new block at i, K = i+1 starts at 0.
+    if (i) {
+      forDivisors(i, 3, [i](int k) {
+        if (!isValid(k)) return;
+        place(k, -1);
+        at[k] = i;
+        place(k, 1);
+      });
     }
-    if (inv != -1) {
-      if (!inverted)
-        mark(i + 1, i - inv + 1);
-      else
-        mark(N - i - 1, i + 1);
+    if (isValid(i + 1)) at[i + 1] = 0, place(i + 1, 1);
+    pool = i + 1;
+    if (i) check(f, i, false);
+
+    // The tail is checked with A[0..i-1] read from the end.
+    if (i) {
+      int j = i - 1;
+      if (A[j] != -1 && r.d != -1) {
+        if (A[j] > A[r.d]) U = r.d;
+        if (A[j] != A[r.d]) unequal(r.d);
+      }
+      r.step(j);
     }
+    bool v = some(0, i, i) || some(0, r.inv + 1, U) ||
+             some(1, max(r.inv, U) + 1, i - 2);
+    writeStr(v ? "Y\n" : "N\n");
+    flushOut();
   }
 }
 
 int main(int argc, char *argv[]) {
   _;
-  FOR(i, 1, maxN) for (int j = 0; j < maxN; j += i) divisors[j].push_back(i);
-  while (scanf("%d", &N) != EOF) {
-    memset(valid, true, sizeof(valid));
-    FOR(i, 0, N) scanf("%d", A + i);
-    check(false);
-    int lo = 0, hi = N - 1;
-    while (lo < hi) swap(A[lo++], A[hi--]);
-    check(true);
-    bool v = false;
-    FOR(i, 3, N + 1) v |= valid[i];
-    printf("%c\n", v ? 'Y' : 'N');
+  sieve();
+#ifdef ONLINE
+  while (readInt(N)) online();
+  return 0;
+#endif
+  while (readInt(N)) {
+    reset();
+    FOR(i, 0, N) readInt(A[i]);
+    if (THREADS == 1) {
+      sweep(false);
+      sweep(true);
+    } else {
+      thread t(sweep, true);
+      sweep(false);
+      t.join();
+    }
+    writeStr(N >= 3 && someValid(3, N) ? "Y\n" : "N\n");
   }
   return 0;
 }
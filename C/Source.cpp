@@ -44,6 +44,28 @@ Note: My implementation is O(N) because I use a trick, since we know that the
 range is always the same we can use a dequeue to keep only the smallest numbers,
 that is we pop from the back if the current number is smaller and we will pop
 from the front if that number comes from an id smaller than i-N.
+
+Note2: Since the sum of G is N times the average, dp[i+N].X = dp[i].X, so the
+range (i-N, i] always contains every X of the ring and the minimum in the range
+is just the minimum X overall. That means we only need the sums of the first N
+positions, we can start right after the minimum X and the answer is:
+
+sum(X) - min(X)*N
+
+Going the other way around the Xs are the same ones negated, so the same sweep
+also gives the answer for the other direction, max(X)*N - sum(X). This is O(N)
+without doubling the array, reversing it or keeping a dequeue.
+
+Note3: The values we need (sum of the Xs, minimum X and maximum X) can be merged
+for 2 consecutive ranges, the Xs of the right range are shifted by the sum of the
+left range. So compiling with -DUPDATES we keep them in a segment tree, changing
+a single table is O(log(N)) and the answer is read from the root. If the average
+changes (the sum of glasses changed) every leaf changes, so we rebuild the tree
+in O(N) on the next query, moving glasses between tables never does that.
+
+Note4: The same merge lets us split the sweep, compiling with -DTHREADS=T every
+thread computes the sums, minimum and maximum of its own block of tables and
+then we merge the T blocks in order.
 */
 
 #include <bits/stdc++.h>
@@ -51,14 +73,14 @@ from the front if that number comes from an id smaller than i-N.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000000000000LL
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -82,51 +104,116 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+#ifndef maxN
 #define maxN 100000
+#endif
+#ifndef maxD
+#define maxD (1 << 17)
+#endif
+#ifndef THREADS
+#define THREADS 1
+#endif
+
+struct Node {
+  ll len, s, pp, lo, hi;
+};
+
+int g[maxN], N, vv, D;
+ll tot;
+Node t[2 * maxD];
+
+Node combine(const Node &l, const Node &r) {
+  return Node{l.len + r.len, l.s + r.s, l.pp + r.pp + l.s * r.len,
+              min(l.lo, l.s + r.lo), max(l.hi, l.s + r.hi)};
+}
 
-int g[maxN], N, vv;
-pll v[2 * maxN];
+ll cost(const Node &n) { return min(n.pp - n.lo * N, n.hi * N - n.pp); }
+
+Node scan(int b, int e) {
+  Node r = Node{e - b, 0, 0, INF, -INF};
+  FOR(i, b, e) {
+    r.s += g[i] - vv;
+    r.pp += r.s;
+    r.lo = min(r.lo, r.s);
+    r.hi = max(r.hi, r.s);
+  }
+  return r;
+}
 
 ll process() {
-  ll mc = INF;
-  deque<pll> los;
-  v[0] = pll(g[0] - vv, g[0] - vv);
-  los.push_back(pll(0, g[0] - vv));
-  FOR(i, 1, 2 * N) {
-    // DP
-    v[i].first = v[i - 1].first + g[i % N] - vv;
-    v[i].second = v[i - 1].second + v[i].first;
-
-    // Deque to keep track of the minimum in the range
-    while (los.size() && los.back().second >= v[i].first) los.pop_back();
-    los.push_back(pll(i, v[i].first));
-    if (los.front().first <= i - N) los.pop_front();
-
-    // Potential answers
-    if (i >= N) {
-      ll st = v[i - N].first;
-      ll lo = los.front().second;
-      if (lo < st) continue;
-      mc = min(mc, v[i].second - v[i - N].second - st * N);
+  Node r[THREADS];
+  if (THREADS == 1) {
+    r[0] = scan(0, N);
+  } else {
+    vector<thread> th;
+    FOR(k, 0, THREADS) {
+      int b = (ll)N * k / THREADS, e = (ll)N * (k + 1) / THREADS;
+      th.emplace_back([&r, k, b, e] { r[k] = scan(b, e); });
     }
+    FORC(th, it) it->join();
   }
-  return mc;
+  FOR(k, 1, THREADS) r[0] = combine(r[0], r[k]);
+  return cost(r[0]);
+}
+
+void setLeaf(int i) {
+  ll x = g[i] - vv;
+  t[D + i] = Node{1, x, x, x, x};
+}
+
+void build() {
+  vv = tot / N;
+  for (D = 1; D < N; D <<= 1)
+    ;
+  FOR(i, 0, D) {
+    if (i < N)
+      setLeaf(i);
+    else
+      t[D + i] = Node{0, 0, 0, INF, -INF};
+  }
+  for (int n = D - 1; n; n--) t[n] = combine(t[n << 1], t[n << 1 | 1]);
+}
+
+void update(int i, int delta) {
+  g[i] += delta;
+  tot += delta;
+  setLeaf(i);
+  for (int n = (D + i) >> 1; n; n >>= 1) {
+    t[n] = combine(t[n << 1], t[n << 1 | 1]);
+  }
+}
+
+// -1 if the glasses can't be split evenly.
+ll query() {
+  if (tot % N) return -1;
+  if (tot / N != vv) build();
+  return cost(t[1]);
 }
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%d", &N) != EOF) {
+  while (readInt(N)) {
     ll ss = 0;
     FOR(i, 0, N) {
-      scanf("%d", g + i);
+      readInt(g[i]);
       ss += g[i];
     }
     vv = ss / N;
-    ll mc = process();
-    int lo = 0, hi = N - 1;
-    while (lo < hi) swap(g[lo++], g[hi--]);
-    mc = min(mc, process());
-    printf("%lld\n", mc);
+    writeInt(process()), writeChar('\n');
+#ifdef UPDATES
+    flushOut();
+    tot = ss;
+    build();
+    int U;
+    readInt(U);
+    FOR(u, 0, U) {
+      int i, delta;
+      readInt(i), readInt(delta);
+      update(i - 1, delta);
+      writeInt(query()), writeChar('\n');
+      flushOut();
+    }
+#endif
   }
   return 0;
 }
@@ -20,6 +20,19 @@ We can check the current position, if it's on we turn it off and go to the next
 one, etc. Until it's not turned on and we turn it on. We can see that it becomes
 amortized constant because if a bit is turned on N times, the next bit will be
 turned on N/2 times, the next N/4, etc.
+
+Note: Instead of one int per bit we keep the number in words of 64 bits, so
+adding 2^t is a normal addition on the word t/64 and the carry moves to the next
+word only when it overflows. We remember the highest word we touched, so we
+only clean up to that word. We also keep the amount of bits turned on while
+adding, every word that overflows loses its 64 bits, so we know the answer
+after every candy (compile with -DONLINE to print it after every candy).
+
+Note2: If the exponents are huge (compile with -DSPARSE, up to 10^18) we can't
+keep every bit, but after sorting them we can add them from the smallest one
+keeping only how many we carry, when the carry reaches 0 we jump directly to the
+next exponent, and while there's carry it halves on every step. So it's
+O(N*log(N)) no matter how big the exponents are.
 */
 
 #include <bits/stdc++.h>
@@ -27,19 +40,20 @@ turned on N/2 times, the next N/4, etc.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
 
 typedef long long ll;
+typedef unsigned long long ull;
 typedef pair<int, int> ii;
 typedef vector<int> vi;
 typedef vector<ii> vii;
@@ -58,25 +72,63 @@ typedef tree<int,        // key
  */
 
 #define maxN 200001
+#define maxW (maxN / 64 + 2)
+
+int N, hi, cc;
+ull d[maxW];
+
+void add(int t) {
+  int w = t >> 6;
+  ull b = 1ULL << (t & 63), o = d[w];
+  d[w] += b;
+  cc += __builtin_popcountll(d[w]) - __builtin_popcountll(o);
+  if (d[w] < b) {
+    while (!++d[++w]) cc -= 64;
+    cc += __builtin_popcountll(d[w]) - __builtin_popcountll(d[w] - 1);
+  }
+  hi = max(hi, w);
+}
+
+bool answer(int n) { return cc == 2 || (cc == 1 && n != 1); }
 
-int N, d[maxN];
+int sparseBits(vector<ll> &t) {
+  sort(t.begin(), t.end());
+  int bits = 0;
+  size_t i = 0;
+  ll c = 0, e = 0;
+  while (i < t.size() || c) {
+    if (!c) e = t[i];
+    while (i < t.size() && t[i] == e) c++, i++;
+    bits += c & 1;
+    c >>= 1;
+    e++;
+  }
+  return bits;
+}
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%d", &N) != EOF) {
-    memset(d, 0, sizeof(d));
+  while (readInt(N)) {
+#ifdef SPARSE
+    vector<ll> t(N);
+    FOR(i, 0, N) readInt(t[i]);
+    cc = sparseBits(t);
+#else
     FOR(i, 0, N) {
       int t;
-      scanf("%d", &t);
-      while (d[t]) d[t++] = 0;
-      d[t] = 1;
+      readInt(t);
+      add(t);
+#ifdef ONLINE
+      writeStr(answer(i + 1) ? "Y\n" : "N\n");
+      flushOut();
+#endif
     }
-    int cc = 0;
-    FOR(i, 0, maxN) if (d[i]) cc++;
-    if (cc == 2 || cc == 1 && N != 1)
-      printf("Y\n");
-    else
-      printf("N\n");
+    FOR(w, 0, hi + 1) d[w] = 0;
+#endif
+#if !defined(ONLINE) || defined(SPARSE)
+    writeStr(answer(N) ? "Y\n" : "N\n");
+#endif
+    cc = hi = 0;
   }
   return 0;
 }
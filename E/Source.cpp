@@ -28,6 +28,29 @@ Don't forget to remove id from the range to be updated.
 
 Note: I used a set for obtaining idNext and idPrev and a segment tree for
 updating the ranges, but any structure works.
+
+Note2: idPrev and idNext are just the closest taller building to each side, so
+they can be found with a stack in O(N) (pop every building that is not taller
+than the current one, the top is the closest taller). And since all the ranges
+are known before printing we don't need the segment tree either, adding 1 to
+[lo, hi] is dif[lo]++ and dif[hi+1]--, and the answer is the prefix sum of dif.
+That's the default now, compiling with -DSEGTREE uses the set and segment tree.
+
+Note3: If the heights don't fit in memory (compile with -DSTREAM) we can split
+the answer of x in the buildings to its left that see it (A) and the ones to its
+right (B). A building j to the right of x sees x only if it's taller than all the
+buildings between them, so it's on the stack of a right to left sweep, same for
+the left side, so we only need to keep the stack plus the ends of those ranges.
+1. Left to right: find idPrev, save the heights and the left ends to disk.
+2. Right to left over those files: find idNext, count B and save it with the
+   right ends.
+3. Left to right over that file: count A and print A + B.
+Memory is the size of the stacks plus the buffers, the rest lives on disk.
+
+Note4: In the segment tree version the sort is the slowest part, the heights fit
+in 32 bits so we pack (height, id) in 64 bits and sort them with 2 passes of a
+radix sort of 16 bits, with -DTHREADS=T every thread counts and places its own
+block of keys.
 */
 
 #include <bits/stdc++.h>
@@ -35,20 +58,25 @@ updating the ranges, but any structure works.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#ifdef STREAM
+#define FASTIO_STREAM
+#endif
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
 
 typedef long long ll;
+typedef unsigned long long ull;
 typedef pair<int, int> ii;
+typedef pair<ll, ll> pll;
 typedef vector<int> vi;
 typedef vector<ii> vii;
 typedef vector<vi> vvi;
@@ -65,20 +93,60 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+#ifndef maxN
 #define maxN 100000
+#endif
+#ifndef THREADS
+#define THREADS 1
+#endif
+#define CHUNK (1 << 16)
+#define RADIX 16
+#define MASK ((1 << RADIX) - 1)
 
 struct Data {
   int id, h;
-  bool operator<(const Data &r) const { return h < r.h; }
 };
 
 struct Node {
   ll ans, lazy;
 };
 
-int N, D, h[maxN];
+int N, D, h[maxN], st[maxN], lf[maxN];
+ll dif[maxN + 1];
 Data dd[maxN];
 Node t[4 * maxN];
+ull key[maxN], tmp[maxN];
+int cnt[THREADS][1 << RADIX];
+
+void parallel(const function<void(int)> &f) {
+  if (THREADS == 1) return f(0);
+  vector<thread> th;
+  FOR(k, 0, THREADS) th.emplace_back(f, k);
+  FORC(th, it) it->join();
+}
+
+// Sorts the keys by their upper 32 bits, RADIX bits per pass.
+void radixSort() {
+  ull *a = key, *b = tmp;
+  for (int sh = 32; sh < 64; sh += RADIX) {
+    parallel([&](int k) {
+      int lo = (ll)N * k / THREADS, hi = (ll)N * (k + 1) / THREADS;
+      memset(cnt[k], 0, sizeof(cnt[k]));
+      FOR(i, lo, hi) cnt[k][(a[i] >> sh) & MASK]++;
+    });
+    int s = 0;
+    FOR(d, 0, 1 << RADIX) FOR(k, 0, THREADS) {
+      int c = cnt[k][d];
+      cnt[k][d] = s;
+      s += c;
+    }
+    parallel([&](int k) {
+      int lo = (ll)N * k / THREADS, hi = (ll)N * (k + 1) / THREADS;
+      FOR(i, lo, hi) b[cnt[k][(a[i] >> sh) & MASK]++] = a[i];
+    });
+    swap(a, b);
+  }
+}
 
 void propagate(int n) {
   if (n < D) {
@@ -102,32 +170,149 @@ void updateRange(int n, int d, int lo, int hi, int v) {
   updateRange(n << 1 | 1, d, max(0, lo - d), hi - d, v);
 }
 
+void segTree() {
+  memset(t, 0, sizeof(t));
+  D = 1 << (int)ceil(log2(N));
+  FOR(i, 0, N) key[i] = (ull)(unsigned)h[i] << 32 | i;
+  radixSort();
+  FOR(i, 0, N) dd[i] = Data{(int)(unsigned)key[i], (int)(key[i] >> 32)};
+  set<int> busy;
+  busy.insert(-2 * N);
+  busy.insert(4 * N);
+  for (int i = N - 1; i >= 0; i--) {
+    auto it = busy.insert(dd[i].id).first;
+    auto it2 = ++it;
+    it--;
+    auto itp = --it;
+    it++;
+    int lo = (*itp + *it) >> 1;
+    int hi = (*it2 + *it + 1) >> 1;
+    updateRange(1, D, max(0, lo + 1), min(hi - 1, N - 1), 1);
+    if (lo + 1 <= hi - 1) updateRange(1, D, *it, *it, -1);
+  }
+  FOR(i, 1, 2 * D) propagate(i);
+  FOR(i, 0, N) dif[i] = t[D + i].ans;
+}
+
+void add(int lo, int hi, int v) {
+  if (lo > hi) return;
+  dif[lo] += v;
+  dif[hi + 1] -= v;
+}
+
+void stacks() {
+  int sc = 0;
+  FOR(i, 0, N) {
+    while (sc && h[st[sc - 1]] < h[i]) sc--;
+    lf[i] = sc ? st[sc - 1] : -2 * N;
+    st[sc++] = i;
+  }
+  memset(dif, 0, sizeof(ll) * (N + 1));
+  sc = 0;
+  for (int i = N - 1; i >= 0; i--) {
+    while (sc && h[st[sc - 1]] < h[i]) sc--;
+    int lo = (lf[i] + i) >> 1;
+    int hi = ((sc ? st[sc - 1] : 4 * N) + i + 1) >> 1;
+    st[sc++] = i;
+    add(max(0, lo + 1), min(hi - 1, N - 1), 1);
+    if (lo + 1 <= hi - 1) add(i, i, -1);
+  }
+  FOR(i, 1, N) dif[i] += dif[i - 1];
+}
+
+// The temporary files hold the whole input, so if the disk can't keep up we
+// stop instead of answering with garbage.
+void check(bool ok, const char *what) {
+  if (ok) return;
+  perror(what);
+  exit(1);
+}
+
+FILE *temporary() {
+  FILE *f = tmpfile();
+  check(f != NULL, "tmpfile");
+  return f;
+}
+
+template <class T>
+void put(const T &x, FILE *f) {
+  check(fwrite(&x, sizeof(x), 1, f) == 1, "fwrite");
+}
+
+// Reads the n records of f from the last one to the first one.
+template <class T>
+struct Backwards {
+  FILE *f;
+  ll left;
+  int pos;
+  vector<T> buf;
+  Backwards(FILE *f, ll n) : f(f), left(n), pos(0), buf(CHUNK) {}
+  T next() {
+    if (!pos) {
+      pos = min(left, (ll)CHUNK);
+      left -= pos;
+      check(fseeko(f, left * sizeof(T), SEEK_SET) == 0, "fseeko");
+      check(fread(buf.data(), sizeof(T), pos, f) == (size_t)pos, "fread");
+    }
+    return buf[--pos];
+  }
+};
+
+void stream(ll n) {
+  FILE *hf = temporary(), *lf = temporary(), *rf = temporary();
+  vector<pll> fr;  // (height, id)
+  for (ll x = 0; x < n; x++) {
+    int h;
+    readInt(h);
+    while (fr.size() && fr.back().first < h) fr.pop_back();
+    ll lo = fr.empty() ? -1 : (fr.back().second + x) >> 1;
+    fr.pb(pll(h, x));
+    put(h, hf);
+    put(lo, lf);
+  }
+
+  // Buildings to the right that see x, by their left end.
+  priority_queue<ll> rs;
+  Backwards<int> hb(hf, n);
+  Backwards<ll> lb(lf, n);
+  fr.clear();
+  for (ll x = n - 1; x >= 0; x--) {
+    int h = hb.next();
+    while (rs.size() && rs.top() >= x) rs.pop();
+    while (fr.size() && fr.back().first < h) fr.pop_back();
+    pll r(fr.empty() ? n : (fr.back().second + x + 1) >> 1, rs.size());
+    fr.pb(pll(h, x));
+    rs.push(lb.next());
+    put(r, rf);
+  }
+
+  // Buildings to the left that see x, by their right end.
+  priority_queue<ll, vector<ll>, greater<ll>> ls;
+  Backwards<pll> rb(rf, n);
+  for (ll x = 0; x < n; x++) {
+    pll r = rb.next();
+    while (ls.size() && ls.top() <= x) ls.pop();
+    writeInt(ls.size() + r.second), writeChar(" \n"[x == n - 1]);
+    ls.push(r.first);
+  }
+  fclose(hf), fclose(lf), fclose(rf);
+}
+
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%d", &N) != EOF) {
-    memset(t, 0, sizeof(t));
-    D = 1 << (int)ceil(log2(N));
-    FOR(i, 0, N) {
-      scanf("%d", h + i);
-      dd[i] = Data{i, h[i]};
-    }
-    sort(dd, dd + N);
-    set<int> busy;
-    busy.insert(-2 * N);
-    busy.insert(4 * N);
-    for (int i = N - 1; i >= 0; i--) {
-      auto it = busy.insert(dd[i].id).first;
-      auto it2 = ++it;
-      it--;
-      auto itp = --it;
-      it++;
-      int lo = *itp + *it >> 1;
-      int hi = *it2 + *it + 1 >> 1;
-      updateRange(1, D, max(0, lo + 1), min(hi - 1, N - 1), 1);
-      if (lo + 1 <= hi - 1) updateRange(1, D, *it, *it, -1);
-    }
-    FOR(i, 1, 2 * D) propagate(i);
-    FOR(i, D, D + N) printf("%lld%c", t[i].ans, " \n"[i == D + N - 1]);
+#ifdef STREAM
+  ll n;
+  while (readInt(n)) stream(n);
+  return 0;
+#endif
+  while (readInt(N)) {
+    FOR(i, 0, N) readInt(h[i]);
+#ifdef SEGTREE
+    segTree();
+#else
+    stacks();
+#endif
+    FOR(i, 0, N) writeInt(dif[i]), writeChar(" \n"[i == N - 1]);
   }
   return 0;
 }
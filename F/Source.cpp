@@ -42,8 +42,24 @@ since the time complexity is O(N^2) anyways. In this memory optimization trick
 we only keep track of the current dp and the previous dp so instead of accessing
 dp[i] we access dp by the last bit of i.
 
-Note2: Probably I could have reused the code for the minimum and maximum to make
-the implementation cleaner.
+Note2: The stack only depends on A, so the pops are the same for the minimum and
+the maximum. Instead of running the DP twice every entry of the stack keeps both
+accumulators (the minimum and the maximum dp seen before reaching the biggest
+number to its left) and both answers are produced in a single pass.
+Note3: Row i only needs row i-1 up to column j-1 to compute column j, so rows
+can be pipelined. Compiling with -DTHREADS=T gives row i to thread i % T, which
+trails row i-1 one block of BLK columns at a time. We keep T+1 rows in memory
+(row i uses dp[i % (T+1)]) and before starting a row the thread waits for the
+previous owner of that row of memory to be completely done.
+Note4: For the maximum the cost max(A[l..r]) satisfies
+max(A[a..d]) + max(A[b..c]) <= max(A[a..c]) + max(A[b..d]) for a<=b<=c<=d, so
+the answer is concave in the number of partitions and a single K can be solved
+with the Aliens trick: pay L for every partition, solve the DP without the
+limit in O(N) with the same stack (keeping the best value so far from the
+bottom of the stack) and binary search L until K partitions are used, that's
+O(N*log(max(A))). The minimum is not convex (3 5 7 1 2 4 gives 7 10 12) so for
+it we just stop the DP after K rows, O(N*K). Compiling with -DQUERIES reads Q
+and then Q values of K after every test and only answers those.
 */
 
 #include <bits/stdc++.h>
@@ -51,14 +67,14 @@ the implementation cleaner.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -82,49 +98,124 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+#ifndef maxN
 #define maxN 8000
+#endif
+#ifndef THREADS
+#define THREADS 1
+#endif
+#define BLK 512
+
+int N, K, a[maxN], q[THREADS][maxN];
+ll lo[THREADS + 1][maxN], hi[THREADS + 1][maxN], ans[maxN][2];
+ll qlo[THREADS][maxN], qhi[THREADS][maxN];
+atomic<int> done[maxN];  // Every column smaller than done[i] is final.
+pll bst[maxN], cum[maxN];
+
+void wait(int i, int c) {
+  while (done[i].load(memory_order_acquire) < c) this_thread::yield();
+}
+
+void row(int i, int *q, ll *qlo, ll *qhi) {
+  ll *plo = lo[(i + THREADS) % (THREADS + 1)];
+  ll *phi = hi[(i + THREADS) % (THREADS + 1)];
+  ll *clo = lo[i % (THREADS + 1)], *chi = hi[i % (THREADS + 1)];
+  if (i > THREADS) wait(i - THREADS - 1, N);
+  int qc = 0;
+  for (int b = i; b < N; b += BLK) {
+    int e = min(N, b + BLK);
+    if (i) wait(i - 1, e - 1);
+    FOR(j, b, e) {
+      ll lo1 = INF, hi1 = 0, mlo = INF, mhi = 0;
+      if (j) lo1 = plo[j - 1], hi1 = phi[j - 1];
+      while (qc && a[q[qc - 1]] < a[j]) {
+        qc--;
+        lo1 = min(lo1, qlo[qc]);
+        hi1 = max(hi1, qhi[qc]);
+      }
+      if (!qc) {
+        if (!i) lo1 = 0;
+      } else {
+        mlo = clo[q[qc - 1]];
+        mhi = chi[q[qc - 1]];
+      }
+      q[qc] = j, qlo[qc] = lo1, qhi[qc++] = hi1;
+      clo[j] = min(lo1 + a[j], mlo);
+      chi[j] = max(hi1 + a[j], mhi);
+    }
+    done[i].store(e, memory_order_release);
+  }
+  ans[i][0] = clo[N - 1];
+  ans[i][1] = chi[N - 1];
+}
+
+void worker(int t) {
+  for (int i = t; i < K; i += THREADS) row(i, q[t], qlo[t], qhi[t]);
+}
+
+// Maximum paying L for every partition, returns the value and the smallest
+// amount of partitions that reaches it (stored negated so we can use max).
+pll aliens(ll L) {
+  int qc = 0;
+  pll f(0, 0);
+  FOR(j, 0, N) {
+    pll b = f;
+    while (qc && a[q[0][qc - 1]] < a[j]) b = max(b, bst[--qc]);
+    pll c(b.first + a[j], b.second);
+    if (qc) c = max(c, cum[qc - 1]);
+    q[0][qc] = j, bst[qc] = b, cum[qc++] = c;
+    f = pll(c.first - L, c.second - 1);
+  }
+  return f;
+}
 
-int N, a[maxN], p[maxN];
-ll dp[2][maxN], lo[maxN];
-pll q[maxN];
+ll maxParts(int k) {
+  ll l = 0, h = 0;
+  FOR(i, 0, N) h = max(h, (ll)a[i] + 1);
+  while (l < h) {
+    ll m = (l + h) >> 1;
+    if (-aliens(m).second <= k)
+      h = m;
+    else
+      l = m + 1;
+  }
+  return aliens(l).first + l * k;
+}
+
+void solve() {
+  FOR(j, 0, N) lo[THREADS][j] = INF, hi[THREADS][j] = 0;
+  FOR(i, 0, K) done[i].store(0);
+  if (THREADS == 1) {
+    worker(0);
+  } else {
+    vector<thread> th;
+    FOR(t, 0, THREADS) th.emplace_back(worker, t);
+    FORC(th, it) it->join();
+  }
+}
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%d", &N) != EOF) {
-    FOR(i, 0, N) scanf("%d", a + i);
-    FOR(j, 0, N) dp[1][j] = INF;
-    FOR(i, 0, N) {
-      int qc = 0;
-      FOR(j, i, N) {
-        ll lo1 = INF, mv = INF;
-        if (j) lo1 = dp[~i & 1][j - 1];
-        while (qc && a[q[qc - 1].first] < a[j]) lo1 = min(lo1, q[--qc].second);
-        if (!qc) {
-          if (!i) lo1 = 0;
-        } else {
-          mv = dp[i & 1][q[qc - 1].first];
-        }
-        q[qc++] = pll(j, lo1);
-        dp[i & 1][j] = min(lo1 + a[j], mv);
-      }
-      lo[i] = dp[i & 1][N - 1];
+  while (readInt(N)) {
+    FOR(i, 0, N) readInt(a[i]);
+#ifdef QUERIES
+    int Q;
+    readInt(Q);
+    vi ks(Q);
+    K = 0;
+    FOR(i, 0, Q) readInt(ks[i]), K = max(K, ks[i]);
+    solve();
+    FOR(i, 0, Q) {
+      writeInt(ans[ks[i] - 1][0]), writeChar(' ');
+      writeInt(maxParts(ks[i])), writeChar('\n');
     }
-
-    FOR(j, 0, N) dp[1][j] = 0;
+#else
+    K = N;
+    solve();
     FOR(i, 0, N) {
-      int qc = 0;
-      FOR(j, i, N) {
-        ll lo1 = 0, mv = 0;
-        if (j) lo1 = dp[~i & 1][j - 1];
-        while (qc && a[q[qc - 1].first] < a[j]) lo1 = max(lo1, q[--qc].second);
-        if (qc) {
-          mv = dp[i & 1][q[qc - 1].first];
-        }
-        q[qc++] = pll(j, lo1);
-        dp[i & 1][j] = max(lo1 + a[j], mv);
-      }
-      printf("%lld %lld\n", lo[i], dp[i & 1][N - 1]);
+      writeInt(ans[i][0]), writeChar(' '), writeInt(ans[i][1]), writeChar('\n');
     }
+#endif
   }
   return 0;
 }
@@ -0,0 +1,174 @@
+/*
+Fast input and output shared by all the solutions.
+
+The input is mapped in memory when it is a regular file and parsed in place,
+otherwise (or with FASTIO_STREAM defined before including this) it is read in
+chunks into a fixed buffer that is refilled when the parsing reaches its end, so
+a pipe is answered as it comes and memory doesn't grow with the input. The
+output is kept in a buffer that is written when it fills up, at exit and on
+flushOut(), so there is no flushing per line and no format strings to interpret.
+
+How to use:
+  _;                 // ioOpen(), reads in.txt and writes out.txt with
+                     // USE_IO_FILES, stdin and stdout otherwise.
+  int n; ll x;
+  readInt(n);        // false at the end of the input, like scanf != EOF.
+  readInt(x);
+  char s[10], c;
+  readToken(s);      // Like scanf("%s").
+  readChar(c);       // Like scanf(" %c").
+  readFixed(x, 2);   // "12.34" -> 1234, extra decimals are dropped.
+  writeInt(x), writeChar('\n'), writeStr("*\n"), writeDouble(0.5, 6);
+  flushOut();        // After every answer when the input is interactive.
+  ioLoad();          // To have all the rest of the input in [ioPos, ioEnd).
+*/
+
+#ifndef FASTIO_H
+#define FASTIO_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const char *ioPos = NULL, *ioEnd = NULL;
+int inFd = -1, outFd = 1, outLen = 0;
+char inBuf[1 << 16], outBuf[1 << 16];
+
+void flushOut() {
+  for (int k = 0; k < outLen;) {
+    ssize_t w = write(outFd, outBuf + k, outLen - k);
+    if (w <= 0) break;
+    k += w;
+  }
+  outLen = 0;
+}
+
+void ioOpen(bool files) {
+  int fd = files ? open("in.txt", O_RDONLY) : 0;
+  if (files) outFd = open("out.txt", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  atexit(flushOut);
+  ioPos = ioEnd = inBuf;
+#ifndef FASTIO_STREAM
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void *m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (m != MAP_FAILED) {
+      madvise(m, st.st_size, MADV_SEQUENTIAL);
+      ioPos = (const char *)m, ioEnd = ioPos + st.st_size;
+      return;
+    }
+  }
+#endif
+  inFd = fd;
+}
+
+// Makes sure there is a character at ioPos, false at the end of the input.
+bool ioFill() {
+  if (ioPos < ioEnd) return true;
+  ssize_t r = inFd < 0 ? 0 : read(inFd, inBuf, sizeof inBuf);
+  if (r <= 0) {
+    inFd = -1;
+    return false;
+  }
+  ioPos = inBuf, ioEnd = inBuf + r;
+  return true;
+}
+
+// Reads the rest of the input, for the parsers that want it all in memory.
+void ioLoad() {
+  if (inFd < 0) return;
+  static std::vector<char> buf;
+  buf.assign(ioPos, ioEnd);
+  size_t n = buf.size();
+  for (ssize_t r;; n += r) {
+    if (buf.size() - n < sizeof inBuf) buf.resize(2 * n + sizeof inBuf);
+    if ((r = read(inFd, buf.data() + n, buf.size() - n)) <= 0) break;
+  }
+  inFd = -1;
+  ioPos = buf.data(), ioEnd = ioPos + n;
+}
+
+// Skips whitespace, false at the end of the input.
+bool skipSpace() {
+  while (ioFill() && (unsigned char)*ioPos <= ' ') ioPos++;
+  return ioPos < ioEnd;
+}
+
+bool isDigit(const char *p) { return p < ioEnd && *p >= '0' && *p <= '9'; }
+
+// Like isDigit(ioPos), but refills the buffer first.
+bool nextDigit() { return ioFill() && isDigit(ioPos); }
+
+template <class T>
+bool readInt(T &x) {
+  if (!skipSpace()) return false;
+  bool neg = *ioPos == '-';
+  if (neg || *ioPos == '+') ioPos++;
+  for (x = 0; nextDigit(); ioPos++) x = x * 10 + (*ioPos - '0');
+  if (neg) x = -x;
+  return true;
+}
+
+bool readToken(char *s) {
+  if (!skipSpace()) return false;
+  while (ioFill() && (unsigned char)*ioPos > ' ') *s++ = *ioPos++;
+  *s = 0;
+  return true;
+}
+
+bool readChar(char &c) {
+  if (!skipSpace()) return false;
+  c = *ioPos++;
+  return true;
+}
+
+// Reads a decimal number times 10^digits, exactly.
+template <class T>
+bool readFixed(T &x, int digits) {
+  if (!skipSpace()) return false;
+  bool neg = *ioPos == '-';
+  if (neg || *ioPos == '+') ioPos++;
+  for (x = 0; nextDigit(); ioPos++) x = x * 10 + (*ioPos - '0');
+  if (ioFill() && *ioPos == '.') ioPos++;
+  for (int k = 0; k < digits; k++) {
+    x = x * 10 + (nextDigit() ? *ioPos++ - '0' : 0);
+  }
+  while (nextDigit()) ioPos++;
+  if (neg) x = -x;
+  return true;
+}
+
+void writeChar(char c) {
+  if (outLen == sizeof outBuf) flushOut();
+  outBuf[outLen++] = c;
+}
+
+void writeStr(const char *s) {
+  while (*s) writeChar(*s++);
+}
+
+template <class T>
+void writeInt(T x) {
+  if (outLen + 24 > (int)sizeof outBuf) flushOut();
+  unsigned long long u = x;
+  if (x < 0) outBuf[outLen++] = '-', u = -u;
+  char d[24];
+  int n = 0;
+  do d[n++] = '0' + u % 10, u /= 10;
+  while (u);
+  while (n) outBuf[outLen++] = d[--n];
+}
+
+// Same digits as printf("%.*f").
+void writeDouble(double x, int digits) {
+  if (outLen + 400 > (int)sizeof outBuf) flushOut();
+  int room = sizeof outBuf - outLen;
+  outLen += snprintf(outBuf + outLen, room, "%.*f", digits, x);
+}
+
+#endif
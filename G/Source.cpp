@@ -111,14 +111,14 @@ n/(n+m), for Bob it's m/(n+m).
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -160,8 +160,8 @@ double solve(int n, int m, int k) {
 int main(int argc, char *argv[]) {
   _;
   FOR(i, 0, maxN) FOR(j, 0, maxN) FOR(k, 0, maxN) dp[i][j][k] = -1;
-  while (scanf("%d", &N) != EOF) {
-    printf("%.6f\n", solve(N, N, 0));
+  while (readInt(N)) {
+    writeDouble(solve(N, N, 0), 6), writeChar('\n');
   }
   return 0;
 }
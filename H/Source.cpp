@@ -49,14 +49,14 @@ capacity amount of such nodes. Worst case stays the same (but might be better).
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -163,23 +163,23 @@ int mat[maxN][maxN];
 int main(int argc, char* argv[]) {
   _;
   int N;
-  while (scanf("%d", &N) != EOF) {
+  while (readInt(N)) {
     memset(mat, 0, sizeof(mat));
     Dinic dd = Dinic(N + 1, 0, N);
     FOR(i, 0, N) {
       int k;
       char ss[6];
-      scanf("%s", ss);
+      readToken(ss);
       if (ss[0] == '*') {
         int t;
-        scanf("%d", &t);
+        readInt(t);
         if (t == 1) t = N + 1;
         mat[i][t - 1] = maxT + 1;
       } else {
         k = atoi(ss);
         FOR(j, 0, k) {
           int t;
-          scanf("%d", &t);
+          readInt(t);
           if (t == 1) t = N + 1;
           mat[i][t - 1]++;
         }
@@ -193,9 +193,9 @@ int main(int argc, char* argv[]) {
     }
     int ans = dd.flow();
     if (ans > maxT) {
-      printf("*\n");
+      writeStr("*\n");
     } else
-      printf("%d\n", ans + 1);
+      writeInt(ans + 1), writeChar('\n');
   }
   return 0;
 }
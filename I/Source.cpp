@@ -69,14 +69,14 @@ o is the origin (0,0) is in the CCW order.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -144,15 +144,15 @@ ll solve(int i, int j) {
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%lld %lld", &h.x, &h.y) != EOF) {
+  while (readInt(h.x) && readInt(h.y)) {
     memset(dp, -1, sizeof(dp));
-    scanf("%lld %lld", &p[0].x, &p[0].y);
+    readInt(p[0].x), readInt(p[0].y);
     p[0] -= h;
     Point g = p[0];
-    scanf("%d", &N);
+    readInt(N);
     N++;
     FOR(i, 1, N) {
-      scanf("%lld %lld", &p[i].x, &p[i].y);
+      readInt(p[i].x), readInt(p[i].y);
       p[i] -= h;
     }
     sort(p, p + N);
@@ -166,7 +166,7 @@ int main(int argc, char *argv[]) {
     }
     FOR(i, 0, N) tt[(i - id + N) % N] = p[i];
     FOR(i, 0, N) p[i] = tt[i];
-    printf("%lld\n", solve(0, 0));
+    writeInt(solve(0, 0)), writeChar('\n');
   }
   return 0;
 }
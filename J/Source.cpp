@@ -45,14 +45,14 @@ the value i*9^d, where d is the dimension index.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -93,37 +93,37 @@ int main(int argc, char *argv[]) {
   _;
   pot9[0] = 1;
   FOR(i, 1, maxR) pot9[i] = pot9[i - 1] * 9;
-  while (scanf("%d %d", &N, &R) != EOF) {
+  while (readInt(N) && readInt(R)) {
     int id = 0;
     memset(comps, 0, sizeof(comps));
     memset(cnts, 0, sizeof(cnts));
     char ch[2];
     FOR(i, 0, N) {
-      scanf("%s", ch);
+      readToken(ch);
       if (ch[0] == 'C') {
         int r;
-        scanf("%d", &r);
+        readInt(r);
         FOR(j, 0, r) {
           int t;
-          scanf("%d", &t);
+          readInt(t);
           comps[id][t - 1]++;
         }
         put(comps[id++], 0, 1, 0);
       } else if (ch[0] == 'D') {
         int t;
-        scanf("%d", &t);
+        readInt(t);
         put(comps[t - 1], 0, -1, 0);
       } else {
         int r, acum = 0, vv[maxR];
         memset(vv, 0, sizeof(vv));
-        scanf("%d", &r);
+        readInt(r);
         FOR(j, 0, r) {
           int t;
-          scanf("%d", &t);
+          readInt(t);
           vv[t - 1]++;
         }
         FOR(i, 0, maxR) { acum += pot9[i] * vv[i]; }
-        printf("%d\n", cnts[acum]);
+        writeInt(cnts[acum]), writeChar('\n');
       }
     }
   }
@@ -36,14 +36,14 @@ creating extra memory.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -77,10 +77,10 @@ ll dp[maxN][maxK];
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%lld %lld", &K, &L) != EOF) {
-    FOR(i, 0, K) FOR(j, 0, K) scanf("%lld", T[i] + j);
-    scanf("%lld", &N);
-    FOR(i, 0, N - 1) scanf("%lld", p + i);
+  while (readInt(K) && readInt(L)) {
+    FOR(i, 0, K) FOR(j, 0, K) readInt(T[i][j]);
+    readInt(N);
+    FOR(i, 0, N - 1) readInt(p[i]);
     FOR(k, 0, K) dp[N - 1][k] = k + 1;
     for (int n = N - 2; n >= 0; n--) {
       FOR(k, 0, K) {
@@ -92,7 +92,7 @@ int main(int argc, char *argv[]) {
         dp[n][k] = (dp[n][k] + v1 - v2 + MOD) % MOD;
       }
     }
-    printf("%lld\n", dp[0][K - 1]);
+    writeInt(dp[0][K - 1]), writeChar('\n');
   }
   return 0;
 }
@@ -14,6 +14,31 @@ This can be done in O(T), there are 2*10^5 possible times.
 We can notice that if we are at position i we can only go to position i+X,
 therefore we can do a linear DP where the current value is dp[i+X] and add 1 if
 the current position is blocked.
+
+Note: To mark the blocked times we add 1 at the start of every meeting and
+remove 1 right after it ends, after a prefix sum a time is blocked if the value
+is positive, so marking is O(N + T). The DP only needs to go up to the last
+blocked time since after that everything is 0.
+
+If the meetings go beyond maxT we merge the overlapping meetings and for every
+possible start count how many times the alarm rings in each meeting directly,
+for a meeting [a, b] that's the amount of multiples of X in [a - T, b - T].
+
+Note2: The blocked times (or the merged meetings) don't depend on X, so to try
+many Xs with the same schedule (compile with -DBATCH) we build them once. Since
+dp[i] = dp[i+X] + op[i], we only need the sums of op[T], op[T+X], op[T+2X], ...
+for T < X, the rest are dp[T] = dp[T-X] - op[T-X]. That's O(T) memory and
+O(E) time per X, so every X can be solved on its own thread (-DTHREADS=T).
+
+Note3: If meetings are added and cancelled (compile with -DUPDATES) we can keep
+for every residue r = i % X (only r <= maxStart matter) a segment tree over the
+times r, r+X, r+2X, ... with how many meetings cover each of them. A meeting
+is a range in every one of those trees, and the amount of blocked times is the
+amount of times with cover bigger than 0, we keep the minimum cover and how many
+times have it. With that dp[T] for T < X is the root of its tree and the rest
+are dp[T] = dp[T-X] - blocked(T-X). The trees only go up to maxT, the parts of
+the meetings after it are kept apart and merged when we need them, and for
+T < X we add their rings like when the meetings go beyond maxT.
 */
 
 #include <bits/stdc++.h>
@@ -21,20 +46,21 @@ the current position is blocked.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
 
 typedef long long ll;
 typedef pair<int, int> ii;
+typedef pair<ll, ll> pll;
 typedef vector<int> vi;
 typedef vector<ii> vii;
 typedef vector<vi> vvi;
@@ -53,32 +79,228 @@ typedef tree<int,        // key
 
 #define maxT 200002
 #define maxStart (60 * 8)
+#ifndef THREADS
+#define THREADS 1
+#endif
+
+int N, X, op[maxT + 1];
+ll E;
+vector<pll> m, u;
+
+// Alarms that ring in [lo, hi] starting at T <= lo.
+ll rings(ll lo, ll hi, ll T, int X) {
+  return hi < lo ? 0 : (hi - T) / X - (lo - T + X - 1) / X + 1;
+}
+
+// Merges the sorted meetings in [b, e) into u.
+template <class I>
+void merge(I b, I e, vector<pll> &u) {
+  u.clear();
+  for (I it = b; it != e; it++) {
+    if (u.size() && it->first <= u.back().second + 1)
+      u.back().second = max(u.back().second, it->second);
+    else
+      u.pb(*it);
+  }
+}
+
+// Marks the blocked times, or merges the meetings if they are too far.
+void schedule() {
+  if (E < maxT) {
+    FOR(i, 0, E + 1) op[i] = 0;
+    FORC(m, it) op[it->first]++, op[it->second + 1]--;
+    FOR(i, 1, E) op[i] += op[i - 1];
+    return;
+  }
+  sort(m.begin(), m.end());
+  merge(m.begin(), m.end(), u);
+}
+
+bool blocked(ll i) { return i < E && op[i] > 0; }
+
+pll dense(int X) {
+  int dp[maxStart + 1], T = 0, C = INF;
+  FOR(t, 0, maxStart + 1) {
+    if (t >= X) {
+      dp[t] = dp[t - X] - blocked(t - X);
+    } else {
+      dp[t] = 0;
+      for (int i = t; i < E; i += X) dp[t] += blocked(i);
+    }
+    if (dp[t] < C) C = dp[t], T = t;
+  }
+  return pll(T, C);
+}
+
+pll sparse(int X) {
+  int T = 0;
+  ll C = LLONG_MAX;
+  FOR(t, 0, maxStart + 1) {
+    ll c = 0;
+    FORC(u, it) c += rings(max(it->first, (ll)t), it->second, t, X);
+    if (c < C) C = c, T = t;
+  }
+  return pll(T, C);
+}
+
+pll solve(int X) { return E < maxT ? dense(X) : sparse(X); }
+
+struct Tree {
+  int n;
+  vi mn, cnt, lz;  // Minimum cover, how many times have it and lazy.
+
+  void init(int size) {
+    n = size;
+    mn.assign(4 * n, 0), cnt.assign(4 * n, 0), lz.assign(4 * n, 0);
+    build(1, 0, n - 1);
+  }
+
+  void pull(int v) {
+    int l = v << 1, r = v << 1 | 1;
+    mn[v] = min(mn[l], mn[r]);
+    cnt[v] = (mn[l] == mn[v] ? cnt[l] : 0) + (mn[r] == mn[v] ? cnt[r] : 0);
+    mn[v] += lz[v];
+  }
 
-int N, X;
-int dp[maxT];
-bool op[maxT];
+  void build(int v, int lo, int hi) {
+    if (lo == hi) {
+      cnt[v] = 1;
+      return;
+    }
+    int mi = (lo + hi) >> 1;
+    build(v << 1, lo, mi);
+    build(v << 1 | 1, mi + 1, hi);
+    pull(v);
+  }
+
+  void add(int v, int lo, int hi, int a, int b, int x) {
+    if (b < lo || hi < a) return;
+    if (a <= lo && hi <= b) {
+      mn[v] += x, lz[v] += x;
+      return;
+    }
+    int mi = (lo + hi) >> 1;
+    add(v << 1, lo, mi, a, b, x);
+    add(v << 1 | 1, mi + 1, hi, a, b, x);
+    pull(v);
+  }
+
+  // Cover of the i-th time.
+  int at(int v, int lo, int hi, int i) {
+    if (lo == hi) return mn[v];
+    int mi = (lo + hi) >> 1;
+    return lz[v] + (i <= mi ? at(v << 1, lo, mi, i) : at(v << 1 | 1, mi + 1, hi, i));
+  }
+
+  int busy() { return n - (mn[1] ? 0 : cnt[1]); }
+};
+
+vector<Tree> tr;
+multiset<pll> tail;  // The parts of the meetings from maxT on.
+
+void meeting(ll s, ll e, int v) {
+  if (e >= maxT) {
+    pll p(max(s, (ll)maxT), e);
+    if (v > 0) {
+      tail.insert(p);
+    } else if (tail.count(p)) {
+      tail.erase(tail.find(p));
+    }
+    e = maxT - 1;
+  }
+  FOR(r, 0, tr.size()) {
+    ll lo = s <= r ? 0 : (s - r + X - 1) / X, hi = e < r ? -1 : (e - r) / X;
+    if (lo <= hi) tr[r].add(1, 0, tr[r].n - 1, lo, hi, v);
+  }
+}
+
+pll best() {
+  vector<pll> w;
+  merge(tail.begin(), tail.end(), w);
+  ll dp[maxStart + 1], C = LLONG_MAX;
+  int T = 0;
+  FOR(t, 0, maxStart + 1) {
+    if (t < X) {
+      dp[t] = tr[t].busy();
+      FORC(w, it) dp[t] += rings(it->first, it->second, t, X);
+    } else {
+      Tree &q = tr[t % X];
+      dp[t] = dp[t - X] - (q.at(1, 0, q.n - 1, t / X - 1) > 0);
+    }
+    if (dp[t] < C) C = dp[t], T = t;
+  }
+  return pll(T, C);
+}
+
+void read() {
+  m.resize(N);
+  E = 0;
+  FOR(i, 0, N) {
+    ll s, d;
+    readInt(s), readInt(d);
+    m[i] = pll(s, s + d);
+    E = max(E, s + d + 1);
+  }
+  schedule();
+}
+
+void print(pll r) {
+  writeInt(r.first), writeChar(' '), writeInt(r.second), writeChar('\n');
+}
 
 int main(int argc, char *argv[]) {
   _;
-  while (scanf("%d %d", &N, &X) != EOF) {
-    memset(op, false, sizeof(op));
+#ifdef BATCH
+  int Q;
+  while (readInt(N) && readInt(Q)) {
+    read();
+    vi xs(Q);
+    vector<pll> r(Q);
+    FOR(i, 0, Q) readInt(xs[i]);
+    auto work = [&](int t) {
+      for (int i = t; i < Q; i += THREADS) r[i] = solve(xs[i]);
+    };
+    if (THREADS == 1) {
+      work(0);
+    } else {
+      vector<thread> th;
+      FOR(t, 0, THREADS) th.emplace_back(work, t);
+      FORC(th, it) it->join();
+    }
+    FOR(i, 0, Q) print(r[i]);
+  }
+  return 0;
+#endif
+#ifdef UPDATES
+  while (readInt(N) && readInt(X)) {
+    tr.resize(min(X, maxStart + 1));
+    FOR(r, 0, tr.size()) tr[r].init((maxT - 1 - r) / X + 1);
     FOR(i, 0, N) {
-      int s, d;
-      scanf("%d %d", &s, &d);
-      FOR(j, s, d + s + 1) op[j] = true;
+      ll s, d;
+      readInt(s), readInt(d);
+      meeting(s, s + d, 1);
     }
-    int T = 0, C = INF;
-    for (int i = maxT - 1; i >= 0; i--) {
-      dp[i] = i + X < maxT ? dp[i + X] : 0;
-      if (op[i]) dp[i]++;
-      if (i <= maxStart) {
-        if (C >= dp[i]) {
-          C = dp[i];
-          T = i;
-        }
-      }
+    pll r = best();
+    print(r);
+    flushOut();
+    int U = 0;
+    readInt(U);
+    FOR(i, 0, U) {
+      char c;
+      ll s, d;
+      if (!readChar(c) || !readInt(s) || !readInt(d)) break;
+      meeting(s, s + d, c == '+' ? 1 : -1);
+      r = best();
+      print(r);
+      flushOut();
     }
-    printf("%d %d\n", T, C);
+  }
+  return 0;
+#endif
+  while (readInt(N) && readInt(X)) {
+    read();
+    pll r = solve(X);
+    print(r);
   }
   return 0;
 }
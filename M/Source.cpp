@@ -120,14 +120,14 @@ comments intact, added some comments of my own.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -310,18 +310,18 @@ char str[maxSize], qs[maxSize];
 
 int main(int argc, char* argv[]) {
   _;
-  while (scanf("%s", str) != EOF) {
-    scanf("%s\n\n", qs);
+  while (readToken(str)) {
+    readToken(qs);
     SuffixAutomaton s;
     int len = strlen(str);
     FOR(i, 0, len) { s.addChar(str[i]); }
-    printf("%lld\n", *s.ans.rbegin());
+    writeInt(*s.ans.rbegin()), writeChar('\n');
     int len2 = strlen(qs);
     FOR(i, 0, len2) {
       if (qs[i] == '-') {
-        printf("%lld\n", s.removeLast());
+        writeInt(s.removeLast()), writeChar('\n');
       } else
-        printf("%lld\n", s.addChar(qs[i]));
+        writeInt(s.addChar(qs[i])), writeChar('\n');
     }
   }
   return 0;
@@ -8,6 +8,21 @@ Difficulty: 1
 
 Parse the string and sum the cents, if the cents are multiple of 100 add 1 to
 the counter. You can parse manually or with scanf.
+
+Note: Reading the price as a double and rounding is slow and stops being exact
+for big amounts, and we only care about the cents anyway. So we work on the
+input in memory (see FastIO.h) and for every price we jump straight to the '.'
+and read the 2 digits after it, the dollars are never parsed. The jump looks at
+16 bytes at a time with SSE2 when the compiler has it.
+
+Note2: Only the running sum mod 100 matters, so a block of prices can be
+counted without knowing what came before it: we keep a histogram of the running
+sums of the block alone, and once we know the sum S of everything before it the
+running sums that are multiples of 100 are the ones where the block had
+(100 - S) % 100. With -DTHREADS=T big cases are cut in T blocks at line
+breaks, every thread fills the histogram of its block and they are joined in
+order. To know where a case ends we first count its N + 1 '$' signs, which is
+much cheaper than parsing the prices.
 */
 
 #include <bits/stdc++.h>
@@ -15,14 +30,18 @@ the counter. You can parse manually or with scanf.
 #include <ext/pb_ds/assoc_container.hpp>
 #include <ext/pb_ds/tree_policy.hpp>
 
+#include "../FastIO.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #define INF 1000000000
 #define FOR(i, a, b) for (int i = int(a); i < int(b); i++)
 #define FORC(cont, it) \
   for (decltype((cont).begin()) it = (cont).begin(); it != (cont).end(); it++)
 #define pb push_back
-#define _                                               \
-  if (argc == 2 && ((string)argv[1]) == "USE_IO_FILES") \
-    freopen("in.txt", "r", stdin), freopen("out.txt", "w", stdout);
+#define _ ioOpen(argc == 2 && ((string)argv[1]) == "USE_IO_FILES");
 
 using namespace std;
 using namespace __gnu_pbds;
@@ -45,19 +64,118 @@ typedef tree<int,        // key
   X.order_of_key(-5); // Lower bound, 0 based position.
  */
 
+#ifndef THREADS
+#define THREADS 1
+#endif
+// Cases with fewer prices than this aren't worth starting threads for.
+#ifndef PARALLEL
+#define PARALLEL (1 << 16)
+#endif
+
+// First '.' or '\n' at or after p, or ioEnd.
+const char *stop(const char *p) {
+#ifdef __SSE2__
+  const __m128i dot = _mm_set1_epi8('.'), nl = _mm_set1_epi8('\n');
+  for (; p + 16 <= ioEnd; p += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    int m = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, dot), _mm_cmpeq_epi8(v, nl)));
+    if (m) return p + __builtin_ctz(m);
+  }
+#endif
+  while (p < ioEnd && *p != '.' && *p != '\n') p++;
+  return p;
+}
+
+// Skips whitespace, false at the end of the input.
+bool skip(const char *&p) {
+  while (p < ioEnd && isspace(*p)) p++;
+  return p < ioEnd;
+}
+
+// Reads "$ddd.cc" and returns cc, a missing cents part counts as 0.
+int readCents(const char *&p) {
+  skip(p);
+  p = stop(p);
+  int c = 0;
+  if (p < ioEnd && *p == '.') {
+    p++;
+    FOR(k, 0, 2) c = c * 10 + (isDigit(p) ? *p++ - '0' : 0);
+  }
+  return c;
+}
+
+int serial(const char *&p, int N) {
+  int cc = 0, ans = 0;
+  FOR(i, 0, N + 1) {
+    cc += readCents(p);
+    if (cc >= 100) cc -= 100;
+    if (i && cc) ans++;
+  }
+  return ans;
+}
+
+// Right after the line of the n-th '$' from p.
+const char *after(const char *p, int n) {
+#ifdef __SSE2__
+  const __m128i dollar = _mm_set1_epi8('$');
+  for (; p + 16 <= ioEnd; p += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    int c = __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(v, dollar)));
+    if (c >= n) break;
+    n -= c;
+  }
+#endif
+  for (; p < ioEnd && n; p++) n -= *p == '$';
+  while (p < ioEnd && *p != '\n') p++;
+  return p;
+}
+
+// Running sums mod 100 of the prices in [b, e) and their total.
+struct Block {
+  int hist[100], sum;
+};
+
+void tally(const char *b, const char *e, Block &r) {
+  memset(r.hist, 0, sizeof r.hist);
+  r.sum = 0;
+  while (skip(b) && b < e) {
+    r.sum += readCents(b);
+    if (r.sum >= 100) r.sum -= 100;
+    r.hist[r.sum]++;
+  }
+}
+
+int parallel(const char *&p, int N) {
+  const char *e = after(p, N + 1), *cut[THREADS + 1];
+  cut[0] = p, cut[THREADS] = e;
+  FOR(t, 1, THREADS) {
+    const char *q = max(cut[t - 1], p + (e - p) / THREADS * t);
+    while (q < e && q[-1] != '\n') q++;
+    cut[t] = q;
+  }
+  Block r[THREADS];
+  vector<thread> th;
+  FOR(t, 0, THREADS) th.emplace_back(tally, cut[t], cut[t + 1], ref(r[t]));
+  FORC(th, it) it->join();
+  // Every running sum that isn't a multiple of 100 counts, but the first one.
+  int s = 0, ans = readCents(p) ? -1 : 0;
+  FOR(t, 0, THREADS) {
+    FOR(c, 0, 100) if ((s + c) % 100) ans += r[t].hist[c];
+    s = (s + r[t].sum) % 100;
+  }
+  p = e;
+  return ans;
+}
+
 int main(int argc, char *argv[]) {
   _;
+  ioLoad();
   int N;
-  while (scanf("%d\n", &N) != EOF) {
-    int cc = 0, ans = 0;
-    FOR(i, 0, N + 1) {
-      double f;
-      scanf("$%lf\n", &f);
-      f -= (ll)f;
-      cc += round(f * 100);
-      if (i && cc % 100) ans++;
-    }
-    printf("%d\n", ans);
+  while (readInt(N)) {
+    bool par = THREADS > 1 && N >= PARALLEL;
+    writeInt(par ? parallel(ioPos, N) : serial(ioPos, N));
+    writeChar('\n');
   }
   return 0;
 }